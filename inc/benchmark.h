@@ -0,0 +1,68 @@
+/************************************************************************************************
+Copyright (c) 2023, Mariano Carcamo marianocarcamo98@gmail.com
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/** \brief Medicion de tiempos de las entradas y salidas digitales
+ **
+ ** Mide con el contador de ciclos DWT->CYCCNT la duracion y la variacion de los metodos de
+ ** entradas y salidas digitales, para comparar su ejecucion desde la memoria flash y desde la SRAM
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include "bsp.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para ejecutar la medicion de tiempos
+ *
+ * Repite cada metodo y guarda el minimo, el maximo y el total de ciclos de cada uno en la variable
+ * results, que se inspecciona con el depurador. La variacion de tiempo es la diferencia entre el
+ * maximo y el minimo. Al terminar enciende el led verde y no retorna
+ *
+ * @param board Puntero al descriptor de la placa
+ */
+
+void BenchmarkRun(board_t board);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* BENCHMARK_H */
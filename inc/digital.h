@@ -22,12 +22,26 @@ SPDX-License-Identifier: MIT
  **
  ** Genera la clase digital que permite determinar entradas y salidas digitales
  **
+ ** Los metodos de lectura de flancos y de escritura de salidas pueden llamarse sobre el mismo
+ ** descriptor desde el programa principal y desde una interrupcion del nucleo M4 sin perder flancos
+ ** ni escrituras. La deteccion de flancos no es segura entre nucleos, ya que los nucleos M0 no
+ ** disponen de LDREX/STREX
+ **
+ ** El estado de las entradas y salidas se almacena en mascaras de bits por puerto GPIO, por lo que
+ ** cada terminal solo puede crearse una vez, ya sea como entrada o como salida. Los metodos de
+ ** puerto exploran todas las entradas de un puerto con una unica lectura y una unica actualizacion
+ ** del estado, y comparten ese estado con los metodos de cada entrada
+ **
+ ** Los metodos de lectura y escritura se ejecutan desde la memoria RAM para que su tiempo de
+ ** ejecucion no dependa de los estados de espera de la memoria flash
+ **
  ** \addtogroup name Module denomination
  ** \brief Brief description of the module
  ** @{ */
 
 /* === Headers files inclusions ================================================================ */
 
+#include "ramfunc.h"
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -57,7 +71,7 @@ typedef struct digital_input_s * digital_input_t;
  * @param port Puerto GPIO que contiene a la entrada
  * @param pin Numero de terminal del puerto GPIO asignado a la entrada
  * @param logic "false" para indicar activo en alto / "true" para indicar activo en bajo
- * @return digital_output_t Puntero al descriptor de la entrada creada
+ * @return digital_input_t Puntero al descriptor de la entrada creada o NULL si el terminal ya esta en uso
  */
 
 digital_input_t DigitalInputCreate(uint8_t port, uint8_t pin, bool logic);
@@ -70,7 +84,7 @@ digital_input_t DigitalInputCreate(uint8_t port, uint8_t pin, bool logic);
  * @return false La entrada se encuentra desactivada
  */
 
-bool DigitalInputGetState(digital_input_t input);
+bool RAMFUNC DigitalInputGetState(digital_input_t input);
 
 /**
  * @brief Metodo para detectar un cambio en la entrada
@@ -80,7 +94,7 @@ bool DigitalInputGetState(digital_input_t input);
  * @return false La entrada no tuvo cambio desde el ultimo llamado
  */
 
-bool DigitalInputHasChange(digital_input_t input);
+bool RAMFUNC DigitalInputHasChange(digital_input_t input);
 
 /**
  * @brief Metodo para detectar el estado activo de la entrada
@@ -90,7 +104,7 @@ bool DigitalInputHasChange(digital_input_t input);
  * @return false La entrada no tuvo una activacion desde el ultimo llamado
  */
 
-bool DigitalInputHasActivated(digital_input_t input);
+bool RAMFUNC DigitalInputHasActivated(digital_input_t input);
 
 /**
  * @brief Metodo para detectar el estado inactivo de la entrada
@@ -100,14 +114,41 @@ bool DigitalInputHasActivated(digital_input_t input);
  * @return false La entrada no tuvo una desactivacion desde el ultimo llamado
  */
 
-bool DigitalInputHasDeactivated(digital_input_t input);
+bool RAMFUNC DigitalInputHasDeactivated(digital_input_t input);
+
+/**
+ * @brief Metodo para detectar cambios en todas las entradas de un puerto
+ *
+ * @param port Puerto GPIO que contiene a las entradas, si no existe el metodo devuelve cero
+ * @return uint32_t Mascara con un bit en uno por cada entrada que tuvo un cambio desde el ultimo llamado
+ */
+
+uint32_t RAMFUNC DigitalInputPortHasChange(uint8_t port);
+
+/**
+ * @brief Metodo para detectar la activacion de todas las entradas de un puerto
+ *
+ * @param port Puerto GPIO que contiene a las entradas, si no existe el metodo devuelve cero
+ * @return uint32_t Mascara con un bit en uno por cada entrada que se activo desde el ultimo llamado
+ */
+
+uint32_t RAMFUNC DigitalInputPortHasActivated(uint8_t port);
+
+/**
+ * @brief Metodo para detectar la desactivacion de todas las entradas de un puerto
+ *
+ * @param port Puerto GPIO que contiene a las entradas, si no existe el metodo devuelve cero
+ * @return uint32_t Mascara con un bit en uno por cada entrada que se desactivo desde el ultimo llamado
+ */
+
+uint32_t RAMFUNC DigitalInputPortHasDeactivated(uint8_t port);
 
 /**
  * @brief Metodo para crear una salida digital
  *
  * @param port Puerto GPIO que contiene a la salida
  * @param pin Numero de terminal del puerto GPIO asignado a la salida
- * @return digital_output_t Puntero al descriptor de la salida creada
+ * @return digital_output_t Puntero al descriptor de la salida creada o NULL si el terminal ya esta en uso
  */
 
 digital_output_t DigitalOutputCreate(uint8_t port, uint8_t pin);
@@ -118,7 +159,7 @@ digital_output_t DigitalOutputCreate(uint8_t port, uint8_t pin);
  * @param output Puntero al descriptor de la salida
  */
 
-void DigitalOutputActivate(digital_output_t output);
+void RAMFUNC DigitalOutputActivate(digital_output_t output);
 
 /**
  * @brief Metodo para apagar una salida digital
@@ -126,7 +167,7 @@ void DigitalOutputActivate(digital_output_t output);
  * @param output Puntero al descriptor de la salida
  */
 
-void DigitalOutputDeactivate(digital_output_t output);
+void RAMFUNC DigitalOutputDeactivate(digital_output_t output);
 
 /**
  * @brief Metodo para invertir el estado de una salida digital
@@ -134,7 +175,7 @@ void DigitalOutputDeactivate(digital_output_t output);
  * @param output Puntero al descriptor de la salida
  */
 
-void DigitalOutputToggle(digital_output_t output);
+void RAMFUNC DigitalOutputToggle(digital_output_t output);
 
 /* === End of documentation ==================================================================== */
 
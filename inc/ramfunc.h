@@ -0,0 +1,74 @@
+/************************************************************************************************
+Copyright (c) 2023, Mariano Carcamo marianocarcamo98@gmail.com
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef RAMFUNC_H
+#define RAMFUNC_H
+
+/** \brief Ejecucion de funciones desde memoria RAM
+ **
+ ** Permite ubicar funciones en la seccion .ramfunc, que el enlazador asigna a la memoria SRAM y
+ ** carga en la memoria flash, para ejecutarlas sin los estados de espera de la memoria flash
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+#ifdef RAMFUNC_DISABLE
+//! Con RAMFUNC_DISABLE (make RAMFUNC=n) las funciones quedan en la memoria flash, para comparar tiempos
+#define RAMFUNC
+#else
+//! Atributo para ubicar una funcion en la memoria RAM, se llama con long_call por estar fuera del alcance de BL
+#define RAMFUNC __attribute__((section(".ramfunc"), noinline, long_call))
+#endif
+
+//! Atributo para las funciones auxiliares de una funcion RAMFUNC, se integran siempre en la funcion
+//! que las llama para evitar una llamada larga y para no depender del nivel de optimizacion
+#define RAMFUNC_INLINE inline __attribute__((always_inline))
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para copiar las funciones de la seccion .ramfunc desde la memoria flash a la RAM
+ *
+ * Debe llamarse al inicio del programa, antes de ejecutar cualquier funcion marcada con RAMFUNC
+ */
+
+void RamFunctionsInit(void);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* RAMFUNC_H */
@@ -0,0 +1,70 @@
+/************************************************************************************************
+Copyright (c) 2023, Mariano Carcamo marianocarcamo98@gmail.com
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef STRESS_H
+#define STRESS_H
+
+/** \brief Prueba de concurrencia de entradas y salidas digitales
+ **
+ ** Usa los mismos descriptores desde una interrupcion y desde el programa principal para comprobar
+ ** que no se pierden ni se duplican flancos y que no se pierden escrituras
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include "bsp.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Metodo para ejecutar la prueba de concurrencia
+ *
+ * Genera flancos en el terminal del led verde del RGB, configurado como salida y leido con un
+ * descriptor de entrada, y los detecta con el mismo descriptor desde la interrupcion SysTick y
+ * desde el programa principal. Ambos contextos invierten ademas la salida del led amarillo. Al
+ * terminar enciende el led verde si la prueba fue correcta o el led rojo si fallo, y no retorna.
+ * Los contadores de la prueba se pueden inspeccionar con el depurador en la variable results
+ *
+ * @param board Puntero al descriptor de la placa
+ */
+
+void StressRun(board_t board);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* STRESS_H */
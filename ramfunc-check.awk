@@ -0,0 +1,61 @@
+# Verifica que los metodos de entradas y salidas digitales se ejecutan desde la SRAM y que la seccion
+# que los contiene se carga desde la memoria flash. Recibe la salida de objdump -h, una linea "==="
+# y la salida de nm. No depende del nombre de la seccion: acepta tanto la seccion .ramfunc de
+# ramfunc.ld como un script de placa que incluya *(.ramfunc*) en .data.
+
+function hex(text, result, index_, digit) {
+    result = 0
+    text = tolower(text)
+    for (index_ = 1; index_ <= length(text); index_++) {
+        digit = index("0123456789abcdef", substr(text, index_, 1))
+        result = result * 16 + digit - 1
+    }
+    return result
+}
+
+/^===$/ {
+    symbols = 1
+    next
+}
+
+!symbols && $1 ~ /^[0-9]+$/ && NF >= 6 {
+    sections++
+    name[sections] = $2
+    size[sections] = hex($3)
+    vma[sections] = hex($4)
+    lma[sections] = $5
+    next
+}
+
+symbols && $3 ~ /^Digital(Input|Output)/ && $3 !~ /Create$/ {
+    count++
+    address = hex($1)
+    found = 0
+    for (section = 1; section <= sections; section++) {
+        if (address >= vma[section] && address < vma[section] + size[section]) {
+            found = section
+        }
+    }
+    if (!found) {
+        printf "%s %s: no pertenece a ninguna seccion\n", $1, $3
+        error = 1
+    } else {
+        printf "%s %s: seccion %s, carga en %s\n", $1, $3, name[found], lma[found]
+        if ($1 !~ /^(100|200)/) {
+            print "  no se ejecuta desde la SRAM"
+            error = 1
+        }
+        if (lma[found] !~ /^1[ab]0/) {
+            print "  la seccion no se carga desde la memoria flash"
+            error = 1
+        }
+    }
+}
+
+END {
+    if (!count) {
+        print "No se encontraron metodos de entradas y salidas digitales"
+        error = 1
+    }
+    exit error
+}
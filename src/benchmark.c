@@ -0,0 +1,238 @@
+/************************************************************************************************
+Copyright (c) 2023, Mariano Carcamo marianocarcamo98@gmail.com
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Medicion de tiempos de las entradas y salidas digitales
+ **
+ ** Cada metodo se mide por separado con el contador de ciclos DWT->CYCCNT, descontando el costo de
+ ** la propia medicion. Se compila con la bandera DIGITAL_BENCHMARK (make BENCHMARK=y) y se compara
+ ** la ejecucion desde la SRAM con la ejecucion desde la memoria flash (make BENCHMARK=y RAMFUNC=n).
+ **
+ ** La exploracion de 4, 32 y 128 entradas usa descriptores creados en terminales distintos de los
+ ** puertos GPIO 2, 3, 4 y 6, que la placa no utiliza y que quedan como entradas, su estado de
+ ** reinicio. Se compara la disposicion anterior, un registro de pin, port, inverted, last_state y
+ ** allocated por entrada con el mismo codigo que tenia digital.c, contra los descriptores actuales
+ ** y contra los metodos de puerto, que exploran 32 entradas con cada llamada.
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "benchmark.h"
+
+#ifdef DIGITAL_BENCHMARK
+
+#include "chip.h"
+#include "ciaa.h"
+#include "digital.h"
+#include <stdint.h>
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef BENCHMARK_SAMPLES
+#define BENCHMARK_SAMPLES 1000
+#endif
+
+#define BENCHMARK_SCANS 3
+
+#define BENCHMARK_INPUTS 128
+
+#define BENCHMARK_PORTS (BENCHMARK_INPUTS / 32)
+
+/* === Private data type declarations ========================================================== */
+
+// Registro de una entrada digital con la disposicion anterior a las mascaras por puerto
+struct legacy_input_s {
+    uint8_t pin;     // Puerto GPIO de la entrada digital
+    uint8_t port;    // Terminal del puerto GPIO de la entrada digital
+    bool inverted;   // La entrada opera con logica invertida
+    bool last_state; // Estado anterior de la entrada digital
+    bool allocated;  // Bandera para indicar que el descriptor esta en uso
+};
+
+// Estructura para almacenar los ciclos medidos de un metodo
+struct benchmark_stat_s {
+    uint32_t min;   // Menor cantidad de ciclos medida
+    uint32_t max;   // Mayor cantidad de ciclos medida
+    uint32_t total; // Suma de los ciclos medidos, el promedio es total / BENCHMARK_SAMPLES
+};
+
+// Estructura para almacenar los resultados de la medicion
+struct benchmark_results_s {
+    bool ram;                                              // Los metodos se ejecutaron desde la SRAM
+    uint32_t clock;                                        // Frecuencia del procesador en Hz
+    uint32_t overhead;                                     // Ciclos de la propia medicion, ya descontados
+    struct benchmark_stat_s get_state;                     // DigitalInputGetState
+    struct benchmark_stat_s has_activated;                 // DigitalInputHasActivated
+    struct benchmark_stat_s port_has_activated;            // DigitalInputPortHasActivated
+    struct benchmark_stat_s activate;                      // DigitalOutputActivate
+    struct benchmark_stat_s toggle;                        // DigitalOutputToggle
+    struct benchmark_stat_s scan_legacy[BENCHMARK_SCANS];  // 4, 32 y 128 entradas con la disposicion anterior
+    struct benchmark_stat_s scan_handles[BENCHMARK_SCANS]; // 4, 32 y 128 entradas con sus descriptores
+    struct benchmark_stat_s scan_ports[BENCHMARK_SCANS];   // 4, 32 y 128 entradas por puerto
+    bool finished;                                         // La medicion termino
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+static void BenchmarkRecord(volatile struct benchmark_stat_s * stat, uint32_t cycles);
+
+static bool RAMFUNC BenchmarkLegacyGetState(struct legacy_input_s * input);
+
+static bool RAMFUNC BenchmarkLegacyHasChange(struct legacy_input_s * input);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static volatile struct benchmark_results_s results = {0};
+
+static const uint32_t scan_sizes[BENCHMARK_SCANS] = {4, 32, 128};
+
+static const uint8_t scan_ports[BENCHMARK_PORTS] = {2, 3, 4, 6};
+
+static digital_input_t scan_inputs[BENCHMARK_INPUTS] = {0};
+
+static struct legacy_input_s legacy_inputs[BENCHMARK_INPUTS] = {0};
+
+/* === Private function implementation ========================================================= */
+
+// Funcion para acumular una medicion descontando el costo de leer el contador de ciclos
+static void BenchmarkRecord(volatile struct benchmark_stat_s * stat, uint32_t cycles) {
+    cycles -= results.overhead;
+    if ((stat->total == 0) || (cycles < stat->min)) {
+        stat->min = cycles;
+    }
+    if (cycles > stat->max) {
+        stat->max = cycles;
+    }
+    stat->total += cycles;
+}
+
+// Funciones con el mismo codigo que tenia digital.c antes de usar mascaras por puerto, ubicadas en
+// la misma memoria que los metodos actuales para que la comparacion sea equivalente
+static bool RAMFUNC BenchmarkLegacyGetState(struct legacy_input_s * input) {
+    if (input->inverted) {
+        return Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, input->port, input->pin) == 0;
+    } else {
+        return Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, input->port, input->pin) != 0;
+    }
+}
+
+static bool RAMFUNC BenchmarkLegacyHasChange(struct legacy_input_s * input) {
+    bool current_state = BenchmarkLegacyGetState(input);
+    bool has_changed = false;
+
+    if (current_state == !(input->last_state))
+        has_changed = true;
+    input->last_state = current_state;
+    return has_changed;
+}
+
+/* === Public function implementation ========================================================== */
+
+void BenchmarkRun(board_t board) {
+    uint32_t start;
+    uint32_t cycles;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    SystemCoreClockUpdate();
+    results.clock = SystemCoreClock;
+#ifdef RAMFUNC_DISABLE
+    results.ram = false;
+#else
+    results.ram = true;
+#endif
+
+    for (uint32_t index = 0; index < BENCHMARK_INPUTS; index++) {
+        uint8_t port = scan_ports[index / 32];
+        uint8_t pin = index % 32;
+
+        scan_inputs[index] = DigitalInputCreate(port, pin, false);
+        legacy_inputs[index].port = port;
+        legacy_inputs[index].pin = pin;
+        legacy_inputs[index].allocated = true;
+    }
+
+    results.overhead = UINT32_MAX;
+    for (int sample = 0; sample < BENCHMARK_SAMPLES; sample++) {
+        start = DWT->CYCCNT;
+        cycles = DWT->CYCCNT - start;
+        if (cycles < results.overhead) {
+            results.overhead = cycles;
+        }
+    }
+
+    for (int sample = 0; sample < BENCHMARK_SAMPLES; sample++) {
+        start = DWT->CYCCNT;
+        DigitalInputGetState(board->tec_1);
+        BenchmarkRecord(&results.get_state, DWT->CYCCNT - start);
+
+        start = DWT->CYCCNT;
+        DigitalInputHasActivated(board->tec_1);
+        BenchmarkRecord(&results.has_activated, DWT->CYCCNT - start);
+
+        start = DWT->CYCCNT;
+        DigitalInputPortHasActivated(TEC_1_GPIO);
+        BenchmarkRecord(&results.port_has_activated, DWT->CYCCNT - start);
+
+        start = DWT->CYCCNT;
+        DigitalOutputActivate(board->led_amarillo);
+        BenchmarkRecord(&results.activate, DWT->CYCCNT - start);
+
+        start = DWT->CYCCNT;
+        DigitalOutputToggle(board->led_amarillo);
+        BenchmarkRecord(&results.toggle, DWT->CYCCNT - start);
+
+        for (int scan = 0; scan < BENCHMARK_SCANS; scan++) {
+            start = DWT->CYCCNT;
+            for (uint32_t index = 0; index < scan_sizes[scan]; index++) {
+                BenchmarkLegacyHasChange(&legacy_inputs[index]);
+            }
+            BenchmarkRecord(&results.scan_legacy[scan], DWT->CYCCNT - start);
+
+            start = DWT->CYCCNT;
+            for (uint32_t index = 0; index < scan_sizes[scan]; index++) {
+                DigitalInputHasChange(scan_inputs[index]);
+            }
+            BenchmarkRecord(&results.scan_handles[scan], DWT->CYCCNT - start);
+
+            start = DWT->CYCCNT;
+            for (uint32_t index = 0; index < scan_sizes[scan]; index += 32) {
+                DigitalInputPortHasChange(scan_ports[index / 32]);
+            }
+            BenchmarkRecord(&results.scan_ports[scan], DWT->CYCCNT - start);
+        }
+    }
+
+    results.finished = true;
+    DigitalOutputActivate(board->led_verde);
+    while (true) {
+    }
+}
+
+#endif
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
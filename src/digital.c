@@ -28,155 +28,244 @@ SPDX-License-Identifier: MIT
 #include "digital.h"
 #include "chip.h"
 #include <stdbool.h>
+#include <stdint.h>
 
 /* === Macros definitions ====================================================================== */
 
-#ifndef OUTPUT_INSTANCES
-#define OUTPUT_INSTANCES 4
+#ifndef GPIO_PORTS
+#define GPIO_PORTS 8
 #endif
 
-#ifndef INPUT_INSTANCES
-#define INPUT_INSTANCES 4
-#endif
+#define GPIO_PINS 32
 
 /* === Private data type declarations ========================================================== */
 
-// Estructura para almacenar el descriptor de una entrada digital
-struct digital_input_s {
-    uint8_t pin;     // Puerto GPIO de la entrada digital
-    uint8_t port;    // Terminal del puerto GPIO de la entrada digital
-    bool inverted;   // La entrada opera con logica invertida
-    bool last_state; // Estado anterior de la entrada digital
-    bool allocated;  // Bandera para indicar que el descriptor esta en uso
-};
-
-// Esctructura para almacenar el descriptor de una salida digital
-struct digital_output_s {
-    uint8_t pin;    // Puerto GPIO de la salida digital
-    uint8_t port;   // Terminal del uerto GPIO de la salida digital
-    bool allocated; // Bandera para indicar que el descriptor esta en uso
-};
+// Las estructuras digital_input_s y digital_output_s no se definen: el descriptor es el indice
+// puerto * GPIO_PINS + terminal + 1 convertido a puntero, el uno extra reserva NULL para los errores
 
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
 
-digital_input_t DigitalInputAllocated(void);
+static bool DigitalAllocate(uint8_t port, uint8_t pin);
+
+static void DigitalMaskWrite(volatile uint32_t * word, uint32_t mask, bool value);
+
+static RAMFUNC_INLINE uint32_t DigitalInputPort(digital_input_t input);
+
+static RAMFUNC_INLINE uint32_t DigitalInputMask(digital_input_t input);
 
-digital_output_t DigitalOutputAllocated(void);
+static RAMFUNC_INLINE uint32_t DigitalOutputPort(digital_output_t output);
+
+static RAMFUNC_INLINE uint32_t DigitalOutputMask(digital_output_t output);
+
+static RAMFUNC_INLINE uint32_t DigitalPortUpdateState(uint32_t port, uint32_t mask, uint32_t * last);
 
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
 
-/* === Private function implementation ========================================================= */
+// Mascara de terminales asignados a una entrada o a una salida en cada puerto
+static volatile uint32_t allocated[GPIO_PORTS] = {0};
 
-// Funcion para asignar un descriptor para crea una nueva entrada digital
-digital_input_t DigitalInputAllocated(void) {
-    digital_input_t input = NULL;
+// Mascara de terminales configurados como entradas en cada puerto
+static volatile uint32_t input_pins[GPIO_PORTS] = {0};
 
-    static struct digital_input_s instances[INPUT_INSTANCES] = {0};
+// Mascara de entradas que operan con logica invertida en cada puerto
+static volatile uint32_t inverted[GPIO_PORTS] = {0};
 
-    for (int index = 0; index < INPUT_INSTANCES; index++) {
-        if (!instances[index].allocated) {
-            instances[index].allocated = true;
-            input = &instances[index];
-            break;
-        }
+// Mascara con el estado anterior de las entradas de cada puerto
+static volatile uint32_t last_state[GPIO_PORTS] = {0};
+
+/* === Private function implementation ========================================================= */
+
+// Funcion para reservar un terminal GPIO que todavia no este en uso
+static bool DigitalAllocate(uint8_t port, uint8_t pin) {
+    uint32_t mask = 1UL << pin;
+    uint32_t state;
+
+    if ((port >= GPIO_PORTS) || (pin >= GPIO_PINS)) {
+        return false;
     }
-    return input;
+    do {
+        state = __LDREXW(&allocated[port]);
+        if (state & mask) {
+            __CLREX();
+            return false;
+        }
+    } while (__STREXW(state | mask, &allocated[port]));
+    return true;
 }
 
-// Funcion para asignar un descriptor para crea una nueva salida digital
-digital_output_t DigitalOutputAllocated(void) {
-    digital_output_t output = NULL;
+// Funcion para cambiar los bits de una mascara sin perder las escrituras de una interrupcion
+static void DigitalMaskWrite(volatile uint32_t * word, uint32_t mask, bool value) {
+    uint32_t state;
 
-    static struct digital_output_s instances[OUTPUT_INSTANCES] = {0};
+    do {
+        state = __LDREXW(word);
+    } while (__STREXW(value ? (state | mask) : (state & ~mask), word));
+}
 
-    for (int index = 0; index < OUTPUT_INSTANCES; index++) {
-        if (!instances[index].allocated) {
-            instances[index].allocated = true;
-            output = &instances[index];
-            break;
-        }
+// Funciones para obtener el puerto y la mascara del terminal a partir del indice del descriptor. El
+// puerto no se trunca, asi un descriptor NULL o fuera de rango da un puerto mayor o igual a GPIO_PORTS
+static RAMFUNC_INLINE uint32_t DigitalInputPort(digital_input_t input) {
+    return ((uintptr_t)input - 1) / GPIO_PINS;
+}
+
+static RAMFUNC_INLINE uint32_t DigitalInputMask(digital_input_t input) {
+    return 1UL << (((uintptr_t)input - 1) % GPIO_PINS);
+}
+
+static RAMFUNC_INLINE uint32_t DigitalOutputPort(digital_output_t output) {
+    return ((uintptr_t)output - 1) / GPIO_PINS;
+}
+
+static RAMFUNC_INLINE uint32_t DigitalOutputMask(digital_output_t output) {
+    return 1UL << (((uintptr_t)output - 1) % GPIO_PINS);
+}
+
+// Funcion para muestrear las entradas de un puerto indicadas por la mascara y reemplazar su estado
+// anterior sin enmascarar interrupciones. Devuelve el estado actual y el anterior de esas entradas,
+// ambos en cero si el puerto no existe
+static RAMFUNC_INLINE uint32_t DigitalPortUpdateState(uint32_t port, uint32_t mask, uint32_t * last) {
+    uint32_t state;
+    uint32_t current;
+
+    if (port >= GPIO_PORTS) {
+        *last = 0;
+        return 0;
     }
-    return output;
+
+    // La entrada se muestrea dentro del ciclo LDREX/STREX: si una interrupcion del mismo nucleo
+    // actualiza el estado en medio, el monitor exclusivo se limpia al salir de la interrupcion,
+    // STREX falla y se vuelve a muestrear, por lo que nunca se guarda una muestra anterior a la
+    // que guardo la interrupcion. No protege contra los nucleos M0, que no disponen de LDREX/STREX.
+    // Todas las entradas de un puerto comparten la palabra de estado, por lo que una interrupcion
+    // que consulte otra entrada del mismo puerto tambien provoca un reintento
+    do {
+        state = __LDREXW(&last_state[port]);
+        current = (LPC_GPIO_PORT->PIN[port] ^ inverted[port]) & mask;
+    } while (__STREXW((state & ~mask) | current, &last_state[port]));
+
+    *last = state & mask;
+    return current;
 }
 
 /* === Public function implementation ========================================================== */
 
 digital_input_t DigitalInputCreate(uint8_t port, uint8_t pin, bool logic) {
-    digital_input_t input = DigitalInputAllocated();
+    digital_input_t input = NULL;
 
-    if (input) {
-        input->port = port;
-        input->pin = pin;
-        input->inverted = logic;
-        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, input->port, input->pin, false);
+    if (DigitalAllocate(port, pin)) {
+        input = (digital_input_t)(uintptr_t)(port * GPIO_PINS + pin + 1);
+        DigitalMaskWrite(&inverted[port], 1UL << pin, logic);
+        DigitalMaskWrite(&last_state[port], 1UL << pin, false);
+        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, port, pin, false);
+        DigitalMaskWrite(&input_pins[port], 1UL << pin, true);
     }
     return input;
 }
 
-bool DigitalInputGetState(digital_input_t input) {
-    if (input->inverted) {
-        return Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, input->port, input->pin) == 0;
-    } else {
-        return Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, input->port, input->pin) != 0;
+bool RAMFUNC DigitalInputGetState(digital_input_t input) {
+    uint32_t port = DigitalInputPort(input);
+
+    if (port >= GPIO_PORTS) {
+        return false;
     }
+    return ((LPC_GPIO_PORT->PIN[port] ^ inverted[port]) & DigitalInputMask(input)) != 0;
 }
 
-bool DigitalInputHasChange(digital_input_t input) {
-    bool current_state = DigitalInputGetState(input);
-    bool has_changed = false;
+bool RAMFUNC DigitalInputHasChange(digital_input_t input) {
+    uint32_t last_state;
+    uint32_t current_state = DigitalPortUpdateState(DigitalInputPort(input), DigitalInputMask(input), &last_state);
 
-    if (current_state == !(input->last_state))
-        has_changed = true;
-    input->last_state = current_state;
-    return has_changed;
+    return current_state != last_state;
 }
 
-bool DigitalInputHasActivated(digital_input_t input) {
-    bool current_state = DigitalInputGetState(input);
-    bool has_activated = false;
+bool RAMFUNC DigitalInputHasActivated(digital_input_t input) {
+    uint32_t last_state;
+    uint32_t current_state = DigitalPortUpdateState(DigitalInputPort(input), DigitalInputMask(input), &last_state);
 
-    if (current_state == true && input->last_state == false)
-        has_activated = true;
-    input->last_state = current_state;
-    return has_activated;
+    return (current_state & ~last_state) != 0;
 }
 
-bool DigitalInputHasDeactivated(digital_input_t input) {
-    bool current_state = DigitalInputGetState(input);
-    bool has_deactivated = false;
+bool RAMFUNC DigitalInputHasDeactivated(digital_input_t input) {
+    uint32_t last_state;
+    uint32_t current_state = DigitalPortUpdateState(DigitalInputPort(input), DigitalInputMask(input), &last_state);
+
+    return (~current_state & last_state) != 0;
+}
 
-    if (current_state == false && input->last_state == true)
-        has_deactivated = true;
-    input->last_state = current_state;
-    return has_deactivated;
+uint32_t RAMFUNC DigitalInputPortHasChange(uint8_t port) {
+    uint32_t last_state;
+    uint32_t current_state;
+
+    if (port >= GPIO_PORTS) {
+        return 0;
+    }
+    current_state = DigitalPortUpdateState(port, input_pins[port], &last_state);
+    return current_state ^ last_state;
+}
+
+uint32_t RAMFUNC DigitalInputPortHasActivated(uint8_t port) {
+    uint32_t last_state;
+    uint32_t current_state;
+
+    if (port >= GPIO_PORTS) {
+        return 0;
+    }
+    current_state = DigitalPortUpdateState(port, input_pins[port], &last_state);
+    return current_state & ~last_state;
+}
+
+uint32_t RAMFUNC DigitalInputPortHasDeactivated(uint8_t port) {
+    uint32_t last_state;
+    uint32_t current_state;
+
+    if (port >= GPIO_PORTS) {
+        return 0;
+    }
+    current_state = DigitalPortUpdateState(port, input_pins[port], &last_state);
+    return ~current_state & last_state;
 }
 
 digital_output_t DigitalOutputCreate(uint8_t port, uint8_t pin) {
-    digital_output_t output = DigitalOutputAllocated();
+    digital_output_t output = NULL;
 
-    if (output) {
-        output->port = port;
-        output->pin = pin;
-        Chip_GPIO_SetPinState(LPC_GPIO_PORT, output->port, output->pin, false);
-        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, output->port, output->pin, true);
+    if (DigitalAllocate(port, pin)) {
+        output = (digital_output_t)(uintptr_t)(port * GPIO_PINS + pin + 1);
+        Chip_GPIO_SetPinState(LPC_GPIO_PORT, port, pin, false);
+        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, port, pin, true);
     }
     return output;
 }
 
-void DigitalOutputActivate(digital_output_t output) {
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, output->port, output->pin, true);
+// Las salidas se escriben con los registros SET, CLR y NOT del GPIO: cada operacion es una unica
+// escritura de 32 bits que no afecta a los demas terminales del puerto, por lo que no se pierden
+// escrituras aunque el mismo descriptor se use desde una interrupcion o desde otro nucleo
+
+void RAMFUNC DigitalOutputActivate(digital_output_t output) {
+    uint32_t port = DigitalOutputPort(output);
+
+    if (port < GPIO_PORTS) {
+        LPC_GPIO_PORT->SET[port] = DigitalOutputMask(output);
+    }
 }
 
-void DigitalOutputDeactivate(digital_output_t output) {
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, output->port, output->pin, false);
+void RAMFUNC DigitalOutputDeactivate(digital_output_t output) {
+    uint32_t port = DigitalOutputPort(output);
+
+    if (port < GPIO_PORTS) {
+        LPC_GPIO_PORT->CLR[port] = DigitalOutputMask(output);
+    }
 }
 
-void DigitalOutputToggle(digital_output_t output) {
-    Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, output->port, output->pin);
+void RAMFUNC DigitalOutputToggle(digital_output_t output) {
+    uint32_t port = DigitalOutputPort(output);
+
+    if (port < GPIO_PORTS) {
+        LPC_GPIO_PORT->NOT[port] = DigitalOutputMask(output);
+    }
 }
 
 /* === End of documentation ==================================================================== */
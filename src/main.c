@@ -40,8 +40,11 @@
 
 /* === Headers files inclusions =============================================================== */
 
+#include "benchmark.h"
 #include "bsp.h"
 #include "digital.h"
+#include "ramfunc.h"
+#include "stress.h"
 #include <stdbool.h>
 
 /* === Macros definitions ====================================================================== */
@@ -64,8 +67,17 @@ int main(void) {
 
     int divisor = 0;
 
+    RamFunctionsInit();
+
     board_t board = BoardCreate();
 
+#ifdef DIGITAL_STRESS_TEST
+    StressRun(board);
+#endif
+#ifdef DIGITAL_BENCHMARK
+    BenchmarkRun(board);
+#endif
+
     while (true) {
         if (DigitalInputGetState(board->tec_1) == true) {
             DigitalOutputActivate(board->led_rgb_azul);
@@ -0,0 +1,193 @@
+/************************************************************************************************
+Copyright (c) 2023, Mariano Carcamo marianocarcamo98@gmail.com
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** \brief Prueba de concurrencia de entradas y salidas digitales
+ **
+ ** La interrupcion SysTick genera los flancos de referencia invirtiendo directamente el registro
+ ** NOT del GPIO, por lo que cambian en cualquier punto del muestreo del programa principal. Cada
+ ** flanco nuevo se genera solo cuando el anterior ya fue detectado por alguno de los dos contextos,
+ ** de modo que la suma de los flancos detectados nunca debe superar a los generados y siempre debe
+ ** alcanzarlos. La salida del led amarillo se invierte desde ambos contextos y la interrupcion
+ ** comprueba que su estado coincida con la paridad de las inversiones realizadas.
+ **
+ ** Solo se compila con la bandera DIGITAL_STRESS_TEST (make STRESS=y)
+ **
+ ** \addtogroup name Module denomination
+ ** \brief Brief description of the module
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "stress.h"
+
+#ifdef DIGITAL_STRESS_TEST
+
+#include "chip.h"
+#include "ciaa.h"
+#include "digital.h"
+#include <stdint.h>
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef STRESS_EDGES
+#define STRESS_EDGES 1000000
+#endif
+
+#ifndef STRESS_TICK_RATE
+#define STRESS_TICK_RATE 20000
+#endif
+
+// Iteraciones del programa principal sin nuevos flancos para considerar que uno se perdio
+#define STRESS_TIMEOUT 10000000
+
+/* === Private data type declarations ========================================================== */
+
+// Estructura para almacenar los resultados de la prueba
+struct stress_results_s {
+    uint32_t edges_generated;  // Flancos generados en el terminal de referencia
+    uint32_t edges_main;       // Flancos detectados por el programa principal
+    uint32_t edges_isr;        // Flancos detectados por la interrupcion
+    uint32_t toggles_main;     // Inversiones de la salida hechas por el programa principal
+    uint32_t toggles_isr;      // Inversiones de la salida hechas por la interrupcion
+    uint32_t duplicated_edges; // Veces que se detectaron mas flancos que los generados
+    uint32_t lost_writes;      // Veces que el estado de la salida no coincidio con las inversiones
+    bool lost_edge;            // Un flanco generado nunca fue detectado
+    bool finished;             // La prueba termino
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+static bool StressCheckEdges(void);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static volatile struct stress_results_s results = {0};
+
+static digital_input_t reference = NULL;
+
+static digital_output_t output = NULL;
+
+static volatile bool running = false;
+
+// Bandera que indica que el programa principal esta entre la escritura y el conteo de la salida
+static volatile bool main_writing = false;
+
+static volatile uint32_t ticks = 0;
+
+/* === Private function implementation ========================================================= */
+
+// Funcion para comprobar que no se detectaron mas flancos que los generados
+static bool StressCheckEdges(void) {
+    if (results.edges_main + results.edges_isr > results.edges_generated) {
+        results.duplicated_edges++;
+        return false;
+    }
+    return results.edges_main + results.edges_isr == results.edges_generated;
+}
+
+/* === Public function implementation ========================================================== */
+
+void SysTick_Handler(void) {
+    uint32_t expected;
+    uint32_t actual;
+
+    if (!running) {
+        return;
+    }
+    ticks++;
+
+    // Genera un flanco nuevo cuando el anterior ya fue detectado
+    if (StressCheckEdges() && results.edges_generated < STRESS_EDGES) {
+        LPC_GPIO_PORT->NOT[LED_G_GPIO] = (1UL << LED_G_BIT);
+        results.edges_generated++;
+    }
+    // En la mitad de las interrupciones el flanco queda para el programa principal
+    if ((ticks & 1) && DigitalInputHasChange(reference)) {
+        results.edges_isr++;
+    }
+
+    DigitalOutputToggle(output);
+    results.toggles_isr++;
+    if (!main_writing) {
+        __DSB();
+        expected = (results.toggles_main + results.toggles_isr) & 1;
+        actual = (LPC_GPIO_PORT->PIN[LED_2_GPIO] >> LED_2_BIT) & 1;
+        if (expected != actual) {
+            results.lost_writes++;
+        }
+    }
+}
+
+void StressRun(board_t board) {
+    uint32_t generated = 0;
+    uint32_t idle = 0;
+
+    // El terminal del led verde del RGB no tiene descriptor en la placa, se lee con un descriptor
+    // de entrada y se vuelve a configurar como salida para generar los flancos de referencia
+    reference = DigitalInputCreate(LED_G_GPIO, LED_G_BIT, false);
+    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, LED_G_GPIO, LED_G_BIT, true);
+    DigitalInputHasChange(reference);
+    output = board->led_amarillo;
+
+    running = true;
+    SystemCoreClockUpdate();
+    SysTick_Config(SystemCoreClock / STRESS_TICK_RATE);
+
+    while (results.edges_generated < STRESS_EDGES || !StressCheckEdges()) {
+        if (DigitalInputHasChange(reference)) {
+            results.edges_main++;
+        }
+        if (!StressCheckEdges() && results.duplicated_edges) {
+            break;
+        }
+
+        main_writing = true;
+        DigitalOutputToggle(output);
+        results.toggles_main++;
+        main_writing = false;
+
+        if (generated != results.edges_generated) {
+            generated = results.edges_generated;
+            idle = 0;
+        } else if (++idle > STRESS_TIMEOUT) {
+            results.lost_edge = true;
+            break;
+        }
+    }
+
+    running = false;
+    SysTick->CTRL = 0;
+    results.finished = true;
+
+    if (results.duplicated_edges || results.lost_writes || results.lost_edge) {
+        DigitalOutputActivate(board->led_rojo);
+    } else {
+        DigitalOutputActivate(board->led_verde);
+    }
+    while (true) {
+    }
+}
+
+#endif
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */